@@ -0,0 +1,105 @@
+/**
+ * @file allocations.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark that counts the heap allocations of the search.
+ * @details The global operator new is replaced by a counting one. Each
+ * neighborhood is applied in place to a copy of the GRC solution, and then
+ * the loop of the GVNS (shaking of the incumbent, GVNSProcedure, and
+ * checkpoint or rollback) is run, reporting the allocations of each part. After the
+ * warm up iterations the loop of the GVNS must not allocate.
+ * Usage: bench_allocations.exe [num_clients] [num_vehicles] [iterations]
+ * @version 0.1
+ * @date 2022-05-19
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+#include <cstdlib>
+#include <new>
+
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t size) {
+  allocations++;
+  void* pointer = std::malloc(size == 0 ? 1 : size);
+  if (pointer == nullptr) {throw std::bad_alloc();}
+  return pointer;
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  allocations++;
+  std::size_t align = static_cast<std::size_t>(alignment);
+  void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align);
+  if (pointer == nullptr) {throw std::bad_alloc();}
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept {std::free(pointer);}
+void operator delete(void* pointer, std::size_t) noexcept {std::free(pointer);}
+void operator delete(void* pointer, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+
+int main(int argc, char* argv[]) {
+  int num_clients = (argc > 1) ? std::stoi(argv[1]) : 200;
+  int num_vehicles = (argc > 2) ? std::stoi(argv[2]) : 4;
+  int iterations = (argc > 3) ? std::stoi(argv[3]) : 200;
+  Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+  Algorithm algorithm(&problem);
+  LocalSearch local_search;
+  local_search.setProblem(&problem);
+  const std::vector<std::string> names = {
+    "swapIntraRoute", "swapInterRoute", "reinsertionIntraRoute",
+    "reinsertionInterRoute", "twoOpt"
+  };
+
+  Solution initial_solution = algorithm.GRC(1);
+  std::cout << "GRC cost=" << initial_solution.getCost() << "\n";
+  // First pass to size the internal buffers of the local search
+  for (size_t i = 0; i < names.size(); i++) {
+    Solution solution = initial_solution;
+    local_search.run(solution, i);
+  }
+  for (size_t i = 0; i < names.size(); i++) {
+    Solution solution = initial_solution;
+    std::size_t before = allocations;
+    local_search.run(solution, i);
+    std::cout << names[i] << "\tcost=" << solution.getCost()
+              << "\tallocations=" << allocations - before << "\n";
+  }
+
+  // Loop of GVNSSolver
+  Solution best_solution = initial_solution;
+  best_solution.checkpoint();
+  std::size_t warm_up_allocations = 0;
+  std::size_t steady_allocations = 0;
+  BenchTimer timer;
+  for (int iteration = 0; iteration < 2 * iterations; iteration++) {
+    std::size_t before = allocations;
+    int k_value = iteration % GVNS_K_VALUE_LIMIT + 1;
+    int best_cost = best_solution.getCost();
+    algorithm.ShakingSolution(best_solution, k_value);
+    algorithm.GVNSProcedure(best_solution);
+    if (best_solution.calculateCost() < best_cost) {
+      best_solution.checkpoint();
+    } else {
+      best_solution.rollback();
+    }
+    if (iteration < iterations) {
+      warm_up_allocations += allocations - before;
+    } else {
+      steady_allocations += allocations - before;
+    }
+  }
+  std::cout << "GVNS loop\tcost=" << best_solution.getCost() << "\t"
+            << timer.elapsedMs() << " ms\n";
+  std::cout << "allocations in the first " << iterations << " iterations\t"
+            << warm_up_allocations << "\n";
+  std::cout << "allocations in the next " << iterations << " iterations\t"
+            << steady_allocations << "\n";
+  return steady_allocations == 0 ? 0 : 1;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file bench_utils.h
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Helpers shared by the benchmarks (synthetic instances and timers).
+ * @version 0.1
+ * @date 2022-05-04
+ */
+
+#ifndef ___BENCH_UTILS___
+#define ___BENCH_UTILS___
+
+#include "../src/problem.h"
+
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <string>
+
+/**
+ * @brief Builds a random asymmetric matrix with distances in [1, 50]
+ * @param num_clients number of clients (without the depot)
+ * @param seed seed of the generator
+ * @return Matrix of (num_clients + 1) x (num_clients + 1) values
+ */
+inline Matrix syntheticMatrix(int num_clients, int seed) {
+  std::mt19937 engine(seed);
+  std::uniform_int_distribution<int> distance(1, 50);
+  Matrix matrix(num_clients + 1, std::vector<int>(num_clients + 1, 0));
+  for (int i = 0; i <= num_clients; i++) {
+    for (int j = 0; j <= num_clients; j++) {
+      if (i != j) matrix[i][j] = distance(engine);
+    }
+  }
+  return matrix;
+}
+
+/**
+ * @brief Builds a random instance (see syntheticMatrix)
+ * @param num_clients number of clients (without the depot)
+ * @param num_vehicles number of vehicles
+ * @param seed seed of the generator
+ * @return Problem
+ */
+inline Problem syntheticProblem(int num_clients, int num_vehicles, int seed) {
+  return Problem(num_vehicles, num_clients + 1,
+                 syntheticMatrix(num_clients, seed));
+}
+
+/**
+ * @brief Writes a random instance in the text format of test/
+ * @details the values are generated row by row, so the matrix is never
+ * stored in memory
+ * @param filename output file
+ * @param num_clients number of clients (without the depot)
+ * @param num_vehicles number of vehicles
+ * @param seed seed of the generator
+ */
+inline void writeSyntheticText(const std::string& filename, int num_clients,
+                               int num_vehicles, int seed) {
+  std::mt19937 engine(seed);
+  std::uniform_int_distribution<int> distance(1, 50);
+  std::ofstream file(filename);
+  file << "n_clientes:\t" << num_clients << "\r\n";
+  file << "n_vehiculos:\t" << num_vehicles << "\r\n";
+  file << "Distancia_entre_cada_par_de_clientes\t\t\t\t\t\r\n";
+  std::string line = "";
+  for (int i = 0; i <= num_clients; i++) {
+    line.clear();
+    for (int j = 0; j <= num_clients; j++) {
+      line += std::to_string(i == j ? 0 : distance(engine));
+      line += (j == num_clients) ? "\r\n" : "\t";
+    }
+    file << line;
+  }
+}
+
+/**
+ * @brief Writes a random instance given by coordinates (text format)
+ * @details the clients are uniformly distributed in a 1000 x 1000 square
+ * @param filename output file
+ * @param num_clients number of clients (without the depot)
+ * @param num_vehicles number of vehicles
+ * @param seed seed of the generator
+ */
+inline void writeSyntheticCoordinates(const std::string& filename,
+                                      int num_clients, int num_vehicles,
+                                      int seed) {
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<double> coordinate(0, 1000);
+  std::ofstream file(filename);
+  file << "n_clientes:\t" << num_clients << "\r\n";
+  file << "n_vehiculos:\t" << num_vehicles << "\r\n";
+  file << "Coordenadas_de_cada_cliente\t\r\n";
+  file.precision(3);
+  file << std::fixed;
+  for (int i = 0; i <= num_clients; i++) {
+    file << coordinate(engine) << "\t" << coordinate(engine) << "\r\n";
+  }
+}
+
+/**
+ * @brief Peak resident memory of the process (Linux only)
+ * @return long kilobytes, or -1 if it is not available
+ */
+inline long peakMemoryKb() {
+  std::ifstream status("/proc/self/status");
+  std::string line = "";
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0) {
+      return std::stol(line.substr(6));
+    }
+  }
+  return -1;
+}
+
+/** @brief Wall clock timer in milliseconds */
+class BenchTimer {
+  private:
+    std::chrono::high_resolution_clock::time_point start_;
+  public:
+    BenchTimer() {reset();};
+    void reset() {start_ = std::chrono::high_resolution_clock::now();};
+    double elapsedMs() const {
+      return std::chrono::duration<double, std::milli>(
+          std::chrono::high_resolution_clock::now() - start_).count();
+    };
+};
+
+#endif
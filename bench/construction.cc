@@ -0,0 +1,54 @@
+/**
+ * @file construction.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the constructions (greedy and GRC) on large instances.
+ * @details For each size it builds greedy solutions and GRC solutions with
+ * the cardinality RCL (full scans and neighbor lists) and with the alpha RCL,
+ * reporting the time of one construction and its cost.
+ * Usage: bench_construction.exe [num_vehicles] [num_clients...]
+ * @version 0.1
+ * @date 2022-05-23
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+int main(int argc, char* argv[]) {
+  int num_vehicles = (argc > 1) ? std::stoi(argv[1]) : 8;
+  std::vector<int> sizes = {1000, 2000, 5000};
+  if (argc > 2) {
+    sizes.clear();
+    for (int i = 2; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  const int num_neighbors = 10;
+  std::cout << "clients\tgreedy\tRCL size 3\tgreedy (k=" << num_neighbors
+            << " neighbors)\tRCL size 3 (k=" << num_neighbors
+            << " neighbors)\tRCL alpha 0.1\n";
+  for (int num_clients : sizes) {
+    Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+    Algorithm algorithm(&problem);
+    std::cout << num_clients;
+
+    for (int round = 0; round < 2; round++) {
+      if (round == 1) {problem.buildNeighborLists(num_neighbors);}
+      BenchTimer timer;
+      Solution solution = algorithm.greedySolver();
+      std::cout << "\t" << timer.elapsedMs() << " ms (" << solution.getCost()
+                << ")";
+
+      timer.reset();
+      solution = algorithm.GRC(1);
+      std::cout << "\t" << timer.elapsedMs() << " ms (" << solution.getCost()
+                << ")";
+    }
+
+    algorithm.setRCLAlpha(0.1);
+    BenchTimer timer;
+    Solution solution = algorithm.GRC(1);
+    std::cout << "\t" << timer.elapsedMs() << " ms (" << solution.getCost()
+              << ")\n";
+  }
+  return 0;
+}
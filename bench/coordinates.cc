@@ -0,0 +1,72 @@
+/**
+ * @file coordinates.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the instances given by coordinates.
+ * @details It writes a synthetic coordinate instance, loads it (distances
+ * computed on demand), builds a GRC solution, applies the granular local
+ * searches and checks the final cost. It reports the time of each phase and
+ * the peak memory of the process.
+ * Usage: bench_coordinates.exe [num_clients] [num_vehicles] [directory]
+ * @version 0.1
+ * @date 2022-05-13
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+/**
+ * @brief Recomputes the cost of a solution with the distances of the problem
+ * @param solution 
+ * @param problem 
+ * @return int 
+ */
+int realCost(Solution& solution, const Problem& problem) {
+  int cost = 0;
+  for (Route& route : solution.getRoutes()) {
+    for (int i = 0; i < route.getSize() - 1; i++) {
+      cost += problem.dist(route[i], route[i + 1]);
+    }
+  }
+  return cost;
+}
+
+int main(int argc, char* argv[]) {
+  int num_clients = (argc > 1) ? std::stoi(argv[1]) : 20000;
+  int num_vehicles = (argc > 2) ? std::stoi(argv[2]) : 8;
+  std::string directory = (argc > 3) ? argv[3] : "bin";
+  std::string filename = directory + "/bench_coordinates_" +
+                         std::to_string(num_clients) + ".txt";
+  writeSyntheticCoordinates(filename, num_clients, num_vehicles, 1);
+
+  BenchTimer timer;
+  Problem problem(filename);
+  std::cout << num_clients << " clients\tload\t" << timer.elapsedMs()
+            << " ms\n";
+
+  Algorithm algorithm(&problem);
+  timer.reset();
+  Solution solution = algorithm.GRC(1);
+  std::cout << "GRC\tcost=" << solution.getCost() << "\t" << timer.elapsedMs()
+            << " ms\n";
+
+  timer.reset();
+  problem.buildNeighborLists(20);
+  std::cout << "neighbor lists k=20\t" << timer.elapsedMs() << " ms\n";
+
+  LocalSearch local_search;
+  local_search.setProblem(&problem);
+  local_search.setGranular(true);
+  const std::vector<std::string> names = {
+    "swapIntraRoute", "swapInterRoute", "reinsertionIntraRoute",
+    "reinsertionInterRoute", "twoOpt"
+  };
+  for (size_t i = 0; i < names.size(); i++) {
+    timer.reset();
+    local_search.run(solution, i);
+    std::cout << names[i] << " (granular)\tcost=" << solution.calculateCost()
+              << "\t" << timer.elapsedMs() << " ms\n";
+  }
+  std::cout << "checked cost\t" << realCost(solution, problem) << "\n";
+  std::cout << "peak memory\t" << peakMemoryKb() / 1024.0 << " MB\n";
+  return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file delta_kernels.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Microbenchmark of the kernels of the reinsertion and swap moves.
+ * @details For each storage type of the matrix it evaluates every client of
+ * a route against every position of another route with the scalar and the
+ * AVX2 kernels, reporting the moves evaluated per second (best of
+ * BENCH_RUNS runs; the best moves found must be the same).
+ * Usage: bench_delta_kernels.exe [num_clients] [route_length] [repetitions]
+ * @version 0.1
+ * @date 2022-05-26
+ */
+
+#include "../src/delta_kernels.h"
+#include "../src/random.h"
+#include "../src/route.h"
+#include "bench_utils.h"
+
+#include <algorithm>
+#include <climits>
+
+const int BENCH_RUNS = 5;
+
+/**
+ * @brief Route with random clients (depot at both ends)
+ * @param length number of clients
+ * @param num_clients number of clients of the problem (with the depot)
+ * @param random
+ * @return Route
+ */
+static Route randomRoute(int length, int num_clients, Random& random) {
+  Route route;
+  route.addClient(0);
+  for (int i = 0; i < length; i++) {
+    route.addClient(1 + random.nextInt(num_clients - 1));
+  }
+  route.addClient(0);
+  return route;
+}
+
+int main(int argc, char* argv[]) {
+  int num_clients = (argc > 1) ? std::stoi(argv[1]) : 2000;
+  int length = (argc > 2) ? std::stoi(argv[2]) : 250;
+  int repetitions = (argc > 3) ? std::stoi(argv[3]) : 20;
+  Problem problem = syntheticProblem(num_clients, 8, 1);
+  Random random(1);
+  Route first_route = randomRoute(length, problem.getNumClients(), random);
+  Route second_route = randomRoute(length, problem.getNumClients(), random);
+  const double moves = static_cast<double>(length) * length * repetitions;
+  bool same_moves = true;
+  std::cout << "AVX2 " << (hasVectorKernels() ? "available" : "not available")
+            << ", " << length << " x " << length << " moves per row set\n";
+  std::cout << "element size\tkernel\tscalar Mmoves/s\tAVX2 Mmoves/s\n";
+
+  for (int element_size : {1, 2, 4}) {
+    problem.setElementSize(element_size);
+    problem.visit([&](const auto& distances) {
+      first_route.updateCumulativeCosts(distances);
+      second_route.updateCumulativeCosts(distances);
+      const int* clients = second_route.getRoute().data();
+      const int* forward = second_route.getForwardCosts();
+      for (int kernel = 0; kernel < 2; kernel++) {
+        double rates[2];
+        long checksums[2];
+        for (int vector = 0; vector < 2; vector++) {
+          setVectorKernels(vector == 1);
+          // Best of several runs (the first ones warm up the caches)
+          rates[vector] = 0;
+          for (int run = 0; run < BENCH_RUNS; run++) {
+            long checksum = 0;
+            BenchTimer timer;
+            for (int r = 0; r < repetitions; r++) {
+              for (int i = 1; i <= length; i++) {
+                BestDelta best = (kernel == 0)
+                    ? bestInsertion(distances, first_route[i], clients,
+                                    forward, 0, length, INT_MAX)
+                    : bestExchange(distances, first_route[i - 1],
+                                   first_route[i], first_route[i + 1],
+                                   clients, forward, 1, length, INT_MAX);
+                checksum += best.delta * 31 + best.index;
+              }
+            }
+            rates[vector] = std::max(rates[vector],
+                                     moves / timer.elapsedMs() / 1000.0);
+            checksums[vector] = checksum;
+          }
+        }
+        same_moves = same_moves && checksums[0] == checksums[1];
+        std::cout << element_size << "\t"
+                  << ((kernel == 0) ? "insertion" : "exchange") << "\t"
+                  << rates[0] << "\t" << rates[1] << "\n";
+      }
+    });
+  }
+  setVectorKernels(true);
+  return same_moves ? 0 : 1;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file distance_access.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the distance matrix access path used by the solvers.
+ * @details It measures a full GRASP run on the test instances and, on a
+ * synthetic 2000 clients instance, one GRC construction and a fixed number of
+ * swap cost evaluations (the operations that read the distance matrix).
+ * @version 0.1
+ * @date 2022-05-02
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+using namespace std::chrono;
+
+int main() {
+  const std::vector<std::string> instances = {
+    "test/I40j_2m_S1_1.txt", "test/I40j_4m_S1_1.txt",
+    "test/I40j_6m_S1_1.txt", "test/I40j_8m_S1_1.txt"
+  };
+  for (const std::string& filename : instances) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+      std::cout << "Error opening file " << filename << "\n";
+      return -1;
+    }
+    Problem problem(file);
+    Algorithm algorithm(&problem);
+    for (int local_search = 0; local_search < 5; local_search++) {
+      auto start = high_resolution_clock::now();
+      Solution solution = algorithm.GRASPSolver(100, 1, local_search);
+      auto stop = high_resolution_clock::now();
+      std::cout << filename << "\tGRASP ls=" << local_search << "\tcost="
+                << solution.getCost() << "\t"
+                << duration_cast<microseconds>(stop - start).count()
+                << " us\n";
+    }
+  }
+
+  Problem problem = syntheticProblem(2000, 4, 1);
+  Algorithm algorithm(&problem);
+  auto start = high_resolution_clock::now();
+  Solution solution = algorithm.GRC(1);
+  auto stop = high_resolution_clock::now();
+  std::cout << "synthetic-2000\tGRC\tcost=" << solution.getCost() << "\t"
+            << duration_cast<microseconds>(stop - start).count() << " us\n";
+
+  LocalSearch local_search;
+  local_search.setProblem(&problem);
+  Route& route = solution.getRoutes()[0];
+  const int evaluations = 200;
+  long long checksum = 0;
+  start = high_resolution_clock::now();
+  for (int i = 0; i < evaluations; i++) {
+    checksum += local_search.swapCost(1 + i, route.getSize() - 2 - i, route);
+  }
+  stop = high_resolution_clock::now();
+  std::cout << "synthetic-2000\t" << evaluations << " swapCost\tchecksum="
+            << checksum << "\t"
+            << duration_cast<microseconds>(stop - start).count() << " us\n";
+  return 0;
+}
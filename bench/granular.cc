@@ -0,0 +1,69 @@
+/**
+ * @file granular.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the granular neighborhoods against the full scans.
+ * @details Every neighborhood is applied to the same GRC solution with the
+ * full scan and with neighbor lists of several lengths, reporting the time
+ * and the cost reached.
+ * Usage: bench_granular.exe [num_clients] [num_vehicles]
+ * @version 0.1
+ * @date 2022-05-11
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+#include <sstream>
+
+int main(int argc, char* argv[]) {
+  int num_clients = (argc > 1) ? std::stoi(argv[1]) : 2000;
+  int num_vehicles = (argc > 2) ? std::stoi(argv[2]) : 4;
+  Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+  Algorithm algorithm(&problem);
+  LocalSearch local_search;
+  local_search.setProblem(&problem);
+  const std::vector<std::string> names = {
+    "swapIntraRoute", "swapInterRoute", "reinsertionIntraRoute",
+    "reinsertionInterRoute", "twoOpt"
+  };
+  const std::vector<int> lengths = {5, 10, 20, 40};
+
+  Solution initial_solution = algorithm.GRC(1);
+  std::cout << "GRC cost=" << initial_solution.getCost() << "\n";
+  std::cout << "neighborhood\tfull";
+  for (int length : lengths) {
+    std::cout << "\tk=" << length;
+  }
+  std::cout << "\n";
+
+  std::vector<std::vector<std::string>> results(names.size());
+  for (int length = -1; length < static_cast<int>(lengths.size()); length++) {
+    if (length >= 0) {
+      BenchTimer timer;
+      problem.buildNeighborLists(lengths[length]);
+      std::cout << "neighbor lists k=" << lengths[length] << " built in "
+                << timer.elapsedMs() << " ms\n";
+    }
+    local_search.setGranular(length >= 0);
+    for (size_t i = 0; i < names.size(); i++) {
+      Solution solution = initial_solution;
+      BenchTimer timer;
+      local_search.run(solution, i);
+      double time = timer.elapsedMs();
+      std::ostringstream result;
+      result.precision(1);
+      result << std::fixed << solution.calculateCost() << " / " << time
+             << " ms";
+      results[i].push_back(result.str());
+    }
+  }
+  std::cout << "cost / time\n";
+  for (size_t i = 0; i < names.size(); i++) {
+    std::cout << names[i];
+    for (const std::string& result : results[i]) {
+      std::cout << "\t" << result;
+    }
+    std::cout << "\n";
+  }
+  return 0;
+}
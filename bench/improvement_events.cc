@@ -0,0 +1,109 @@
+/**
+ * @file improvement_events.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the improvement events handed to another thread.
+ * @details GVNSSolver and GRASPSolver (on setNumThreads workers) run without
+ * an observer and with an IncumbentExchange, whose solutions are taken by a
+ * reader thread that polls it (like a dispatcher). Each solution taken must
+ * have the cost of its event and of its routes, the last one must be the
+ * solution returned, and the observer must not change the result. It
+ * reports the time of both runs, the events, the solutions taken and the
+ * mean delay between an event and its take.
+ * Usage: bench_improvement_events.exe [num_vehicles] [grasp_threads]
+ * [num_clients...]
+ * @version 0.1
+ * @date 2022-06-02
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+#include <atomic>
+#include <thread>
+
+// Iterations of the solvers
+const int GVNS_ITERATIONS = 20;
+const int GRASP_ITERATIONS = 200;
+
+/**
+ * @brief Check that the routes of a solution add up to its cost
+ * @param solution
+ * @return true if they do
+ */
+static bool checkCost(Solution& solution) {
+  int cost = 0;
+  for (Route& route : solution.getRoutes()) {
+    cost += route.getCost();
+  }
+  return cost == solution.getCost();
+}
+
+int main(int argc, char* argv[]) {
+  int num_vehicles = (argc > 1) ? std::stoi(argv[1]) : 8;
+  int grasp_threads = (argc > 2) ? std::stoi(argv[2]) : 2;
+  std::vector<int> sizes = {100, 200};
+  if (argc > 3) {
+    sizes.clear();
+    for (int i = 3; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  const std::vector<std::string> names = {"GVNSSolver", "GRASPSolver"};
+  bool right = true;
+  std::cout << "clients\tsolver\tcost\ttime\tobserved time\tevents\ttaken"
+            << "\tmean delay\n";
+  for (int num_clients : sizes) {
+    Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+    for (int s = 0; s < 2; s++) {
+      Algorithm algorithm(&problem);
+      algorithm.setGVNSLimits(GVNS_ITERATIONS, GVNS_K_VALUE_LIMIT);
+      algorithm.setNumThreads(grasp_threads);
+      auto solve = [&]() {
+        algorithm.setSeed(1);
+        return (s == 0) ? algorithm.GVNSSolver()
+                        : algorithm.GRASPSolver(GRASP_ITERATIONS, 1, 2);
+      };
+      BenchTimer plain_timer;
+      Solution plain = solve();
+      double plain_time = plain_timer.elapsedMs();
+
+      IncumbentExchange exchange;
+      algorithm.setObserver(&exchange);
+      std::atomic<bool> done(false);
+      int taken = 0;
+      int last_cost = -1;
+      double delays = 0;
+      BenchTimer timer;
+      std::thread reader([&]() {
+        bool finished = false;
+        while (!finished) {
+          finished = done;
+          const ImprovementEvent* event = exchange.take();
+          if (event == nullptr) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            continue;
+          }
+          delays += timer.elapsedMs() - event->elapsed_ms;
+          right = right && event->cost == event->solution->getCost() &&
+                  checkCost(*event->solution);
+          last_cost = event->cost;
+          taken++;
+        }
+      });
+      Solution observed = solve();
+      double observed_time = timer.elapsedMs();
+      done = true;
+      reader.join();
+      algorithm.setObserver(nullptr);
+
+      right = right && observed.getCost() == plain.getCost() &&
+              last_cost == observed.getCost();
+      std::cout << num_clients << "\t" << names[s] << "\t"
+                << observed.getCost() << "\t" << plain_time << " ms\t"
+                << observed_time << " ms\t" << algorithm.getTrace().size()
+                << "\t" << taken << "\t" << delays / std::max(1, taken)
+                << " ms\n";
+    }
+  }
+  return right ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file instance_loading.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the start up time (loading of the instance).
+ * @details It writes a synthetic text instance, converts it to the binary
+ * format and measures the time to load each one and the time of the first
+ * full read of the distances (for the binary instance that includes the page
+ * faults of the mapping).
+ * Usage: bench_instance_loading.exe [directory] [num_clients...]
+ * @version 0.1
+ * @date 2022-05-04
+ */
+
+#include "bench_utils.h"
+
+#include <iostream>
+
+/**
+ * @brief Reads every distance of the problem
+ * @param problem problem to read
+ * @return long long sum of all the distances
+ */
+long long touchDistances(const Problem& problem) {
+  return problem.visit([&](const auto& distances) {
+    long long checksum = 0;
+    for (int i = 0; i < problem.getNumClients(); i++) {
+      const auto* row = distances.row(i);
+      for (int j = 0; j < problem.getNumClients(); j++) {
+        checksum += row[j];
+      }
+    }
+    return checksum;
+  });
+}
+
+/**
+ * @brief Loads an instance and prints the times
+ * @param label name of the format
+ * @param filename instance to load
+ */
+void measure(const std::string& label, const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary | std::ios::ate);
+  double megabytes = file.tellg() / (1024.0 * 1024.0);
+  BenchTimer timer;
+  Problem problem(filename);
+  double load_time = timer.elapsedMs();
+  timer.reset();
+  long long checksum = touchDistances(problem);
+  double touch_time = timer.elapsedMs();
+  std::cout << label << "\t" << megabytes << " MB\t"
+            << problem.getElementSize() << " B/distance\tload=" << load_time
+            << " ms (" << megabytes / (load_time / 1000.0) << " MB/s)"
+            << "\tfirst scan=" << touch_time << " ms\tchecksum=" << checksum
+            << "\n";
+}
+
+int main(int argc, char* argv[]) {
+  std::string directory = (argc > 1) ? argv[1] : "bin";
+  std::vector<int> sizes = {1000, 5000, 10000};
+  if (argc > 2) {
+    sizes.clear();
+    for (int i = 2; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  for (int num_clients : sizes) {
+    std::string text_filename = directory + "/bench_instance_" +
+                                std::to_string(num_clients) + ".txt";
+    std::string binary_filename = directory + "/bench_instance_" +
+                                  std::to_string(num_clients) + ".bin";
+
+    BenchTimer timer;
+    writeSyntheticText(text_filename, num_clients, 4, 1);
+    std::cout << num_clients << " clients, generated " << text_filename
+              << " in " << timer.elapsedMs() << " ms\n";
+    Problem(text_filename).writeBinary(binary_filename);
+
+    measure("text  ", text_filename);
+    measure("binary", binary_filename);
+  }
+  return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file journal.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the rejected shakings of the GVNS: copy or rollback.
+ * @details Starting from a local optimum of the GVNS procedure, each cycle
+ * shakes the incumbent with k = 1..GVNS_K_VALUE_LIMIT and rejects it, like
+ * most iterations of GVNSSolver. The copy method shakes a copy of the
+ * incumbent (the former GVNSSolver), and the journal method shakes the
+ * incumbent itself and rolls it back to its checkpoint. Both see the same
+ * shakings (same seed), and it reports the time per cycle (best of
+ * BENCH_RUNS runs) without and with the GVNS procedure after the shaking.
+ * The incumbent must be the same after the cycles.
+ * Usage: bench_journal.exe [num_vehicles] [cycles] [num_clients...]
+ * @version 0.1
+ * @date 2022-05-31
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+const int BENCH_RUNS = 3;
+
+int main(int argc, char* argv[]) {
+  int num_vehicles = (argc > 1) ? std::stoi(argv[1]) : 8;
+  int num_cycles = (argc > 2) ? std::stoi(argv[2]) : 2000;
+  std::vector<int> sizes = {200, 500, 1000};
+  if (argc > 3) {
+    sizes.clear();
+    for (int i = 3; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  bool same_solutions = true;
+  std::cout << "clients\tprocedure\tcopy time\tjournal time\n";
+  for (int num_clients : sizes) {
+    Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+    Algorithm algorithm(&problem);
+    Solution incumbent = algorithm.GRC(1);
+    algorithm.GVNSProcedure(incumbent);
+    for (int vnd = 0; vnd < 2; vnd++) {
+      // The GVNS procedure is much slower than the shaking
+      int cycles = (vnd == 0) ? num_cycles : num_cycles / 20 + 1;
+      double times[2] = {0, 0};
+      for (int method = 0; method < 2; method++) {
+        for (int run = 0; run < BENCH_RUNS; run++) {
+          Solution best_solution = incumbent;
+          Solution candidate = best_solution;
+          best_solution.checkpoint();
+          algorithm.setSeed(1);
+          BenchTimer timer;
+          for (int cycle = 0; cycle < cycles; cycle++) {
+            int k_value = cycle % GVNS_K_VALUE_LIMIT + 1;
+            Solution& shaken = (method == 0) ? candidate : best_solution;
+            if (method == 0) {candidate = best_solution;}
+            algorithm.ShakingSolution(shaken, k_value);
+            if (vnd == 1) {algorithm.GVNSProcedure(shaken);}
+            if (method == 1) {best_solution.rollback();}
+          }
+          double time = timer.elapsedMs() * 1000 / cycles;
+          times[method] = (run == 0) ? time : std::min(times[method], time);
+          for (int r = 0; r < best_solution.getRoutes().size(); r++) {
+            same_solutions = same_solutions &&
+                best_solution.getRoutes()[r].getRoute() ==
+                incumbent.getRoutes()[r].getRoute();
+          }
+          same_solutions = same_solutions &&
+              best_solution.getCost() == incumbent.getCost();
+        }
+      }
+      std::cout << num_clients << "\t"
+                << ((vnd == 0) ? "ShakingSolution" : "+GVNSProcedure") << "\t"
+                << times[0] << " us\t" << times[1] << " us\n";
+    }
+  }
+  return same_solutions ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file linked_route.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the linked solution against the vector routes.
+ * @details Random relocations, the shaking of the GVNS and the granular
+ * reinsertion local search are applied to the same GRC solution with both
+ * representations on long routes, reporting the time and checking that the
+ * costs kept by the moves match the costs recomputed from scratch.
+ * Usage: bench_linked_route.exe [num_clients] [num_vehicles] [num_moves]
+ * @version 0.1
+ * @date 2022-05-18
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+/**
+ * @brief Cost of a solution recomputed from the distance matrix
+ * @param solution 
+ * @param problem 
+ * @return int 
+ */
+int recomputedCost(Solution& solution, Problem& problem) {
+  int cost = 0;
+  for (Route& route : solution.getRoutes()) {
+    for (int i = 0; i < route.getSize() - 1; i++) {
+      cost += problem.dist(route[i], route[i + 1]);
+    }
+  }
+  return cost;
+}
+
+int main(int argc, char* argv[]) {
+  int num_clients = (argc > 1) ? std::stoi(argv[1]) : 2000;
+  int num_vehicles = (argc > 2) ? std::stoi(argv[2]) : 2;
+  int num_moves = (argc > 3) ? std::stoi(argv[3]) : 100000;
+  Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+  Algorithm algorithm(&problem);
+  LocalSearch local_search;
+  local_search.setProblem(&problem);
+
+  Solution initial_solution = algorithm.GRC(1);
+  std::cout << "GRC cost=" << initial_solution.getCost() << "\n";
+
+  // Random relocations (vector insert / erase against an O(1) relink)
+  Random random(1);
+  std::vector<Route> routes = initial_solution.getRoutes();
+  BenchTimer timer;
+  for (int i = 0; i < num_moves; i++) {
+    int first = random.nextInt(routes.size());
+    int second = random.nextInt(routes.size());
+    if (routes[first].getSize() <= 4) {continue;}
+    int from = random.nextInt(routes[first].getSize() - 2) + 1;
+    int to = random.nextInt(routes[second].getSize() - 1);
+    if (first == second && (to == from || to == from - 1)) {continue;}
+    Route& source = routes[first];
+    Route& target = routes[second];
+    int client = source[from];
+    source.getCost() += - problem.dist(source[from - 1], client)
+                        - problem.dist(client, source[from + 1])
+                        + problem.dist(source[from - 1], source[from + 1]);
+    target.getCost() += - problem.dist(target[to], target[to + 1])
+                        + problem.dist(target[to], client)
+                        + problem.dist(client, target[to + 1]);
+    if (first == second) {
+      source.Displace(from, to);
+    } else {
+      target.insert(to, source.remove(from));
+    }
+  }
+  double vector_time = timer.elapsedMs();
+  Solution vector_solution(routes);
+  std::cout << "relocations\tvector " << vector_time << " ms (cost "
+            << vector_solution.calculateCost() << ", recomputed "
+            << recomputedCost(vector_solution, problem) << ")\n";
+
+  random.setSeed(1);
+  LinkedSolution linked(initial_solution, problem.getNumClients());
+  timer.reset();
+  for (int i = 0; i < num_moves; i++) {
+    int client = random.nextInt(problem.getNumClients());
+    int after = random.nextInt(linked.getNumNodes());
+    if (linked.isDepot(client) || after == client ||
+        after == linked.getPrevious(client) ||
+        linked.getRouteOf(after) == -1 || linked.getNext(after) == -1 ||
+        linked.getSize(linked.getRouteOf(client)) <= 4) {
+      continue;
+    }
+    local_search.reinsert(client, after, linked);
+  }
+  double linked_time = timer.elapsedMs();
+  Solution linked_solution = linked.toSolution();
+  std::cout << "relocations\tlinked " << linked_time << " ms (cost "
+            << linked_solution.getCost() << ", recomputed "
+            << recomputedCost(linked_solution, problem) << ")\n";
+
+  // Shaking of the GVNS (k = GVNS_K_VALUE_LIMIT)
+  const int num_shakes = num_moves / 100;
+  Solution shaked_solution = initial_solution;
+  timer.reset();
+  for (int i = 0; i < num_shakes; i++) {
+    algorithm.ShakingSolution(shaked_solution, GVNS_K_VALUE_LIMIT);
+  }
+  std::cout << "shaking\tvector " << timer.elapsedMs() << " ms (cost "
+            << shaked_solution.calculateCost() << ", recomputed "
+            << recomputedCost(shaked_solution, problem) << ")\n";
+  LinkedSolution shaked(initial_solution, problem.getNumClients());
+  timer.reset();
+  for (int i = 0; i < num_shakes; i++) {
+    algorithm.ShakingSolution(shaked, GVNS_K_VALUE_LIMIT);
+  }
+  shaked_solution = shaked.toSolution();
+  std::cout << "shaking\tlinked " << timer.elapsedMs() << " ms (cost "
+            << shaked_solution.getCost() << ", recomputed "
+            << recomputedCost(shaked_solution, problem) << ")\n";
+
+  // Granular reinsertion local search
+  problem.buildNeighborLists(10);
+  local_search.setGranular(true);
+  Solution improved = initial_solution;
+  timer.reset();
+  local_search.reinsertionIntraRoute(improved);
+  local_search.reinsertionInterRoute(improved);
+  std::cout << "reinsertion k=10\tvector " << timer.elapsedMs() << " ms (cost "
+            << improved.calculateCost() << ", recomputed "
+            << recomputedCost(improved, problem) << ")\n";
+  LinkedSolution searched(initial_solution, problem.getNumClients());
+  timer.reset();
+  local_search.reinsertionProcedure(searched);
+  improved = searched.toSolution();
+  std::cout << "reinsertion k=10\tlinked " << timer.elapsedMs() << " ms (cost "
+            << improved.getCost() << ", recomputed "
+            << recomputedCost(improved, problem) << ")\n";
+  return 0;
+}
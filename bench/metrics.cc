@@ -0,0 +1,110 @@
+/**
+ * @file metrics.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Breakdown of the time and the moves of the solvers per neighborhood
+ * and per phase (built with -DENABLE_METRICS, see the Makefile).
+ * @details GVNSSolver runs on synthetic instances and prints the counters of
+ * each neighborhood (passes, moves evaluated and applied, improvement and
+ * time) and of each phase. The counters must be consistent (no more moves
+ * applied than evaluated, no negative improvements), the same in two runs
+ * with the same seed, and GRASPSolver must count the same moves with one
+ * thread and with grasp_threads threads.
+ * Usage: bench_metrics.exe [num_vehicles] [grasp_threads] [num_clients...]
+ * @version 0.1
+ * @date 2022-06-03
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+// Iterations of the solvers
+const int GVNS_ITERATIONS = 20;
+const int GRASP_ITERATIONS = 40;
+
+/**
+ * @brief Check that two runs evaluated and applied the same moves
+ * @param first
+ * @param second
+ * @return true if they did
+ */
+static bool sameMoves(const Metrics& first, const Metrics& second) {
+  for (int n = 0; n < METRICS_NEIGHBORHOODS; n++) {
+    const NeighborhoodMetrics& a = first.getNeighborhood(n);
+    const NeighborhoodMetrics& b = second.getNeighborhood(n);
+    if (a.calls != b.calls || a.evaluated != b.evaluated ||
+        a.applied != b.applied || a.improvement != b.improvement) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  int num_vehicles = (argc > 1) ? std::stoi(argv[1]) : 8;
+  int grasp_threads = (argc > 2) ? std::stoi(argv[2]) : 2;
+  std::vector<int> sizes = {100, 200};
+  if (argc > 3) {
+    sizes.clear();
+    for (int i = 3; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  if (!METRICS_ENABLED) {
+    std::cout << "Counters disabled (build with -DENABLE_METRICS)\n";
+    return 1;
+  }
+  bool right = true;
+  for (int num_clients : sizes) {
+    Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+    Algorithm algorithm(&problem);
+    algorithm.setGVNSLimits(GVNS_ITERATIONS, GVNS_K_VALUE_LIMIT);
+    algorithm.setSeed(1);
+    BenchTimer timer;
+    Solution solution = algorithm.GVNSSolver();
+    double time = timer.elapsedMs();
+    Metrics metrics = algorithm.getMetrics();
+
+    std::cout << num_clients << " clients: GVNSSolver cost "
+              << solution.getCost() << " in " << time << " ms\n"
+              << "neighborhood\tcalls\tevaluated\tapplied\timprovement"
+              << "\ttime\n";
+    for (int n = 0; n < METRICS_NEIGHBORHOODS; n++) {
+      const NeighborhoodMetrics& counters = metrics.getNeighborhood(n);
+      std::cout << NEIGHBORHOOD_NAMES[n] << "\t" << counters.calls << "\t"
+                << counters.evaluated << "\t" << counters.applied << "\t"
+                << counters.improvement << "\t" << counters.milliseconds
+                << " ms\n";
+      right = right && counters.applied <= counters.evaluated &&
+              counters.improvement >= 0 &&
+              (counters.applied == 0) == (counters.improvement == 0);
+    }
+    std::cout << "phase\tcalls\ttime\n";
+    for (int p = 0; p < METRICS_PHASES; p++) {
+      const PhaseMetrics& counters = metrics.getPhase(MetricsPhase(p));
+      std::cout << PHASE_NAMES[p] << "\t" << counters.calls << "\t"
+                << counters.milliseconds << " ms\n";
+    }
+    right = right && metrics.getPhase(CONSTRUCTION_PHASE).calls == 1 &&
+            metrics.getPhase(SHAKING_PHASE).calls ==
+                metrics.getPhase(VND_PHASE).calls;
+
+    algorithm.setSeed(1);
+    algorithm.GVNSSolver();
+    right = right && sameMoves(metrics, algorithm.getMetrics());
+
+    // GRASP with the intra-route reinsertion
+    algorithm.setNumThreads(1);
+    algorithm.GRASPSolver(GRASP_ITERATIONS, 1, 2);
+    Metrics sequential = algorithm.getMetrics();
+    algorithm.setNumThreads(grasp_threads);
+    algorithm.GRASPSolver(GRASP_ITERATIONS, 1, 2);
+    Metrics parallel = algorithm.getMetrics();
+    right = right && sameMoves(sequential, parallel) &&
+            parallel.getPhase(CONSTRUCTION_PHASE).calls == GRASP_ITERATIONS &&
+            parallel.getPhase(LOCAL_SEARCH_PHASE).calls == GRASP_ITERATIONS;
+    std::cout << "GRASPSolver (" << grasp_threads << " threads): "
+              << parallel.getNeighborhood(2).applied << " moves applied of "
+              << parallel.getNeighborhood(2).evaluated << " evaluated\n\n";
+  }
+  return right ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file move_cache.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the cache of the inter-route neighborhoods.
+ * @details The inter-route swap and reinsertion are applied to the same GRC
+ * solutions with the full recomputation of every pass and with the cache of
+ * the best moves, reporting the moves evaluated (see LocalSearch::getMetrics,
+ * so it is built with -DENABLE_METRICS), the time and the cost reached (it
+ * must be the same).
+ * Usage: bench_move_cache.exe [num_vehicles] [num_clients...]
+ * @version 0.1
+ * @date 2022-05-25
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+int main(int argc, char* argv[]) {
+  int num_vehicles = (argc > 1) ? std::stoi(argv[1]) : 8;
+  std::vector<int> sizes = {200, 500, 1000};
+  if (argc > 2) {
+    sizes.clear();
+    for (int i = 2; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  const std::vector<std::string> names = {"swapInterRoute",
+                                          "reinsertionInterRoute"};
+  // Numbers of the neighborhoods in LocalSearch::run
+  const int neighborhoods[2] = {LocalSearch::InterRouteSwap::ID,
+                                LocalSearch::InterRouteReinsertion::ID};
+  if (!METRICS_ENABLED) {
+    std::cout << "Counters disabled (build with -DENABLE_METRICS)\n";
+    return 1;
+  }
+  bool same_costs = true;
+  std::cout << "clients\tneighborhood\tfull evaluations\tcached evaluations"
+            << "\tfull time\tcached time\tcost\n";
+  for (int num_clients : sizes) {
+    Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+    Algorithm algorithm(&problem);
+    Solution initial_solution = algorithm.GRC(1);
+    for (size_t n = 0; n < names.size(); n++) {
+      std::uint64_t evaluations[2];
+      double times[2];
+      int costs[2];
+      for (int cached = 0; cached < 2; cached++) {
+        LocalSearch local_search;
+        local_search.setProblem(&problem);
+        local_search.setMoveCache(cached == 1);
+        Solution solution = initial_solution;
+        BenchTimer timer;
+        local_search.run(solution, neighborhoods[n]);
+        times[cached] = timer.elapsedMs();
+        evaluations[cached] =
+            local_search.getMetrics().getNeighborhood(neighborhoods[n])
+                .evaluated;
+        costs[cached] = solution.getCost();
+      }
+      same_costs = same_costs && costs[0] == costs[1];
+      std::cout << num_clients << "\t" << names[n] << "\t" << evaluations[0]
+                << "\t" << evaluations[1] << "\t" << times[0] << " ms\t"
+                << times[1] << " ms\t" << costs[0] << " / " << costs[1]
+                << "\n";
+    }
+  }
+  return same_costs ? 0 : 1;
+}
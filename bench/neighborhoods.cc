@@ -0,0 +1,72 @@
+/**
+ * @file neighborhoods.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the neighborhoods of the local search.
+ * @details Each neighborhood (and the GVNS procedure, that chains them) is
+ * applied to the same GRC solution, reporting the cost reached and the time.
+ * The cost of every route is checked against the sum of its arcs.
+ * Usage: bench_neighborhoods.exe [num_vehicles] [num_clients...]
+ * @version 0.1
+ * @date 2022-05-27
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+/**
+ * @brief Check that the cost of each route is the sum of its arcs
+ * @param problem
+ * @param solution
+ * @return true if every cost is right
+ */
+static bool checkCosts(const Problem& problem, Solution& solution) {
+  for (Route& route : solution.getRoutes()) {
+    int cost = 0;
+    for (int i = 0; i < route.getSize() - 1; i++) {
+      cost += problem.dist(route[i], route[i + 1]);
+    }
+    if (cost != route.getCost()) {return false;}
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  int num_vehicles = (argc > 1) ? std::stoi(argv[1]) : 8;
+  std::vector<int> sizes = {100, 200, 500};
+  if (argc > 2) {
+    sizes.clear();
+    for (int i = 2; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  // Neighborhoods in the order of LocalSearch::run
+  const std::vector<std::string> names = {
+      "swapIntraRoute", "swapInterRoute", "reinsertionIntraRoute",
+      "reinsertionInterRoute", "twoOpt", "orOptIntraRoute",
+      "orOptInterRoute", "crossExchange"};
+  bool right_costs = true;
+  std::cout << "clients\tneighborhood\tinitial cost\tcost\ttime\n";
+  for (int num_clients : sizes) {
+    Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+    Algorithm algorithm(&problem);
+    Solution initial_solution = algorithm.GRC(0);
+    LocalSearch local_search;
+    local_search.setProblem(&problem);
+    for (size_t n = 0; n <= names.size(); n++) {
+      Solution solution = initial_solution;
+      BenchTimer timer;
+      if (n < names.size()) {
+        local_search.run(solution, n);
+      } else {
+        algorithm.GVNSProcedure(solution);
+      }
+      double time = timer.elapsedMs();
+      right_costs = right_costs && checkCosts(problem, solution);
+      std::cout << num_clients << "\t"
+                << ((n < names.size()) ? names[n] : "GVNSProcedure") << "\t"
+                << initial_solution.getCost() << "\t" << solution.getCost()
+                << "\t" << time << " ms\n";
+    }
+  }
+  return right_costs ? 0 : 1;
+}
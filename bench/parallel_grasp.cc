@@ -0,0 +1,52 @@
+/**
+ * @file parallel_grasp.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of GRASPSolver with several numbers of threads.
+ * @details The same GRASP (seed 1) is solved with 1, 2, 4, ... threads up to
+ * the given maximum, reporting the time and checking that every run returns
+ * the same solution.
+ * Usage: bench_parallel_grasp.exe [num_clients] [num_vehicles] [iterations]
+ * [max_threads]
+ * @version 0.1
+ * @date 2022-05-20
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+#include <thread>
+
+int main(int argc, char* argv[]) {
+  int num_clients = (argc > 1) ? std::stoi(argv[1]) : 300;
+  int num_vehicles = (argc > 2) ? std::stoi(argv[2]) : 4;
+  int iterations = (argc > 3) ? std::stoi(argv[3]) : 32;
+  int max_threads = (argc > 4) ? std::stoi(argv[4])
+                               : std::thread::hardware_concurrency();
+  Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+  Algorithm algorithm(&problem);
+  std::cout << "hardware threads=" << std::thread::hardware_concurrency()
+            << "\n";
+
+  std::vector<std::vector<int>> reference = {};
+  bool same = true;
+  double serial_time = 0;
+  for (int threads = 1; threads <= std::max(1, max_threads); threads *= 2) {
+    algorithm.setNumThreads(threads);
+    BenchTimer timer;
+    Solution solution = algorithm.GRASPSolver(iterations, 1, 3);
+    double time = timer.elapsedMs();
+    if (threads == 1) {serial_time = time;}
+    std::vector<std::vector<int>> routes = {};
+    for (Route& route : solution.getRoutes()) {
+      routes.push_back(route.getRoute());
+    }
+    if (reference.empty()) {reference = routes;}
+    same = same && routes == reference;
+    std::cout << "threads=" << threads << "\tcost=" << solution.getCost()
+              << "\t" << time << " ms\tspeedup=" << serial_time / time
+              << "\n";
+  }
+  std::cout << (same ? "same solution with every number of threads\n"
+                     : "ERROR: the solution depends on the threads\n");
+  return same ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file parallel_pairs.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the inter-route neighborhoods in parallel rounds.
+ * @details The inter-route swap, the inter-route reinsertion and the GVNS
+ * procedure are applied to the same GRC solution in order (0 threads) and in
+ * rounds of disjoint pairs of routes with 1, 2, 4 and 8 threads, reporting
+ * the cost reached and the time (best of BENCH_RUNS runs). The rounds must
+ * reach the same cost whatever the number of threads.
+ * Usage: bench_parallel_pairs.exe [num_vehicles] [num_clients...]
+ * @version 0.1
+ * @date 2022-05-29
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+const int BENCH_RUNS = 3;
+
+int main(int argc, char* argv[]) {
+  int num_vehicles = (argc > 1) ? std::stoi(argv[1]) : 8;
+  std::vector<int> sizes = {100, 200, 500};
+  if (argc > 2) {
+    sizes.clear();
+    for (int i = 2; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  const std::vector<std::string> names = {
+      "swapInterRoute", "reinsertionInterRoute", "GVNSProcedure"};
+  // Neighborhoods of LocalSearch::run (-1 for the GVNS procedure)
+  const int neighborhoods[3] = {1, 3, -1};
+  const int threads[5] = {0, 1, 2, 4, 8};
+  bool same_costs = true;
+  std::cout << "clients\tprocedure\tthreads\tinitial cost\tcost\ttime\n";
+  for (int num_clients : sizes) {
+    Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+    Algorithm algorithm(&problem);
+    Solution initial_solution = algorithm.GRC(0);
+    LocalSearch local_search;
+    local_search.setProblem(&problem);
+    for (int n = 0; n < 3; n++) {
+      int rounds_cost = -1;
+      for (int num_threads : threads) {
+        local_search.setPairThreads(num_threads);
+        algorithm.setPairThreads(num_threads);
+        double best_time = 0;
+        int cost = 0;
+        for (int run = 0; run < BENCH_RUNS; run++) {
+          Solution solution = initial_solution;
+          BenchTimer timer;
+          if (neighborhoods[n] >= 0) {
+            local_search.run(solution, neighborhoods[n]);
+          } else {
+            algorithm.GVNSProcedure(solution);
+          }
+          double time = timer.elapsedMs();
+          best_time = (run == 0) ? time : std::min(best_time, time);
+          cost = solution.calculateCost();
+        }
+        if (num_threads > 0) {
+          same_costs = same_costs && (rounds_cost < 0 || rounds_cost == cost);
+          rounds_cost = cost;
+        }
+        std::cout << num_clients << "\t" << names[n] << "\t" << num_threads
+                  << "\t" << initial_solution.getCost() << "\t" << cost
+                  << "\t" << best_time << " ms\n";
+      }
+    }
+  }
+  return same_costs ? 0 : 1;
+}
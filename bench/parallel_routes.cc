@@ -0,0 +1,72 @@
+/**
+ * @file parallel_routes.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the intra-route neighborhoods on several threads.
+ * @details The intra-route swap, the intra-route reinsertion, the 2-opt and
+ * the GVNS procedure are applied to the same GRC solution in one thread (0
+ * threads) and with the routes at the same time on 1, 2, 4 and 8 threads,
+ * reporting the cost reached and the time (best of BENCH_RUNS runs). The
+ * routes are improved on their own, so every number of threads must reach
+ * the same cost. The threshold of clients is 0, to use the threads at every
+ * size.
+ * Usage: bench_parallel_routes.exe [num_vehicles] [num_clients...]
+ * @version 0.1
+ * @date 2022-05-30
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+const int BENCH_RUNS = 3;
+
+int main(int argc, char* argv[]) {
+  int num_vehicles = (argc > 1) ? std::stoi(argv[1]) : 8;
+  std::vector<int> sizes = {200, 500, 1000};
+  if (argc > 2) {
+    sizes.clear();
+    for (int i = 2; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  const std::vector<std::string> names = {
+      "swapIntraRoute", "reinsertionIntraRoute", "twoOpt", "GVNSProcedure"};
+  // Neighborhoods of LocalSearch::run (-1 for the GVNS procedure)
+  const int neighborhoods[4] = {0, 2, 4, -1};
+  const int threads[5] = {0, 1, 2, 4, 8};
+  bool same_costs = true;
+  std::cout << "clients\tprocedure\tthreads\tinitial cost\tcost\ttime\n";
+  for (int num_clients : sizes) {
+    Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+    Algorithm algorithm(&problem);
+    Solution initial_solution = algorithm.GRC(0);
+    LocalSearch local_search;
+    local_search.setProblem(&problem);
+    for (int n = 0; n < 4; n++) {
+      int serial_cost = -1;
+      for (int num_threads : threads) {
+        local_search.setRouteThreads(num_threads, 0);
+        algorithm.setRouteThreads(num_threads, 0);
+        double best_time = 0;
+        int cost = 0;
+        for (int run = 0; run < BENCH_RUNS; run++) {
+          Solution solution = initial_solution;
+          BenchTimer timer;
+          if (neighborhoods[n] >= 0) {
+            local_search.run(solution, neighborhoods[n]);
+          } else {
+            algorithm.GVNSProcedure(solution);
+          }
+          double time = timer.elapsedMs();
+          best_time = (run == 0) ? time : std::min(best_time, time);
+          cost = solution.calculateCost();
+        }
+        same_costs = same_costs && (serial_cost < 0 || serial_cost == cost);
+        serial_cost = cost;
+        std::cout << num_clients << "\t" << names[n] << "\t" << num_threads
+                  << "\t" << initial_solution.getCost() << "\t" << cost
+                  << "\t" << best_time << " ms\n";
+      }
+    }
+  }
+  return same_costs ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file scaling.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Scaling benchmark of the constructions and the neighborhoods.
+ * @details For each size it generates an instance (InstanceGenerator, seed
+ * 1), builds the greedy and the GRC solutions and applies each neighborhood
+ * once, in the order of GVNSProcedure, to the GRC solution. It prints the
+ * time of every phase and the cost after it.
+ * Usage: bench_scaling.exe [num_vehicles] [symmetric|asymmetric]
+ * [random|clustered] [num_clients...]
+ * (num_vehicles 0 uses one vehicle every 250 clients, at least 2)
+ * @version 0.1
+ * @date 2022-05-16
+ */
+
+#include "../src/algorithm.h"
+#include "../src/instance_generator.h"
+#include "bench_utils.h"
+
+int main(int argc, char* argv[]) {
+  int vehicles_option = (argc > 1) ? std::stoi(argv[1]) : 0;
+  bool symmetric = (argc > 2) && std::string(argv[2]) == "symmetric";
+  bool clustered = (argc > 3) && std::string(argv[3]) == "clustered";
+  std::vector<int> sizes = {40, 100, 250, 500, 1000, 2000, 5000};
+  if (argc > 4) {
+    sizes.clear();
+    for (int i = 4; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  // Order of GVNSProcedure
+  const std::vector<std::pair<std::string, int>> neighborhoods = {
+    {"reinsertionIntraRoute", 2}, {"reinsertionInterRoute", 3},
+    {"swapIntraRoute", 0}, {"swapInterRoute", 1}, {"twoOpt", 4}
+  };
+
+  std::cout << "clients\tvehicles\tgreedy\tGRC";
+  for (const auto& neighborhood : neighborhoods) {
+    std::cout << "\t" << neighborhood.first;
+  }
+  std::cout << "\tfinal cost\n";
+  for (int num_clients : sizes) {
+    int num_vehicles = vehicles_option > 0 ? vehicles_option
+                                           : std::max(2, num_clients / 250);
+    InstanceGenerator generator(num_clients, num_vehicles, 1);
+    generator.setSymmetric(symmetric);
+    generator.setClustered(clustered);
+    Problem problem = generator.generate();
+    Algorithm algorithm(&problem);
+    LocalSearch local_search;
+    local_search.setProblem(&problem);
+
+    std::cout << num_clients << "\t" << num_vehicles;
+    BenchTimer timer;
+    Solution greedy = algorithm.greedySolver();
+    std::cout << "\t" << timer.elapsedMs() << " ms (" << greedy.getCost()
+              << ")";
+    timer.reset();
+    Solution solution = algorithm.GRC(1);
+    std::cout << "\t" << timer.elapsedMs() << " ms (" << solution.getCost()
+              << ")";
+    for (const auto& neighborhood : neighborhoods) {
+      timer.reset();
+      local_search.run(solution, neighborhood.second);
+      std::cout << "\t" << timer.elapsedMs() << " ms ("
+                << solution.calculateCost() << ")" << std::flush;
+    }
+    std::cout << "\t" << solution.getCost() << "\n";
+  }
+  return 0;
+}
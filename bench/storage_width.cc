@@ -0,0 +1,53 @@
+/**
+ * @file storage_width.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the local searches with each distance storage type.
+ * @details The same synthetic instance (distances in [1, 50]) is stored with
+ * 1, 2 and 4 bytes per distance, and every neighborhood is applied to the
+ * same GRC solution. The resulting costs must be equal for every width.
+ * Usage: bench_storage_width.exe [num_clients] [num_vehicles]
+ * @version 0.1
+ * @date 2022-05-09
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+int main(int argc, char* argv[]) {
+  int num_clients = (argc > 1) ? std::stoi(argv[1]) : 3000;
+  int num_vehicles = (argc > 2) ? std::stoi(argv[2]) : 8;
+  Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+  const std::vector<std::string> names = {
+    "swapIntraRoute", "swapInterRoute", "reinsertionIntraRoute",
+    "reinsertionInterRoute", "twoOpt"
+  };
+
+  for (int element_size : {4, 2, 1}) {
+    problem.setElementSize(element_size);
+    Algorithm algorithm(&problem);
+    LocalSearch local_search;
+    local_search.setProblem(&problem);
+    double matrix_megabytes = static_cast<double>(problem.getNumClients()) *
+                              problem.getNumClients() * element_size /
+                              (1024.0 * 1024.0);
+    std::cout << element_size << " B/distance (" << matrix_megabytes
+              << " MB)\n";
+
+    BenchTimer timer;
+    Solution initial_solution = algorithm.GRC(1);
+    std::cout << "  GRC\tcost=" << initial_solution.getCost() << "\t"
+              << timer.elapsedMs() << " ms\n";
+    double total_time = 0;
+    for (size_t i = 0; i < names.size(); i++) {
+      Solution solution = initial_solution;
+      timer.reset();
+      local_search.run(solution, i);
+      double time = timer.elapsedMs();
+      total_time += time;
+      std::cout << "  " << names[i] << "\tcost=" << solution.calculateCost()
+                << "\t" << time << " ms\n";
+    }
+    std::cout << "  total local search\t" << total_time << " ms\n";
+  }
+  return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file time_to_target.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Time-to-target curves of the solvers on the benchmark instances.
+ * @details Each solver (GVNSSolver, and GRASPSolver with the intra-route
+ * reinsertion) runs with the deadline of setTimeLimit and a different seed
+ * per run. The target of a solver on an instance is the best cost of its
+ * runs plus a gap (GRASP does not reach the costs of GVNS), and the time of
+ * a run is the first improvement of its trace that reaches it. The curve is
+ * the empirical probability of reaching the target before each time,
+ * (i - 0.5) / runs for the i-th shortest time (the runs that do not reach it
+ * are not in the curve).
+ * Usage: bench_time_to_target.exe [runs] [time_limit_ms] [gap] [instances...]
+ * @version 0.1
+ * @date 2022-06-01
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Iterations of GRASPSolver (the deadline stops it first)
+const int GRASP_MAX_ITERATIONS = 1 << 30;
+
+int main(int argc, char* argv[]) {
+  int num_runs = (argc > 1) ? std::stoi(argv[1]) : 20;
+  double time_limit = (argc > 2) ? std::stod(argv[2]) : 200;
+  double gap = (argc > 3) ? std::stod(argv[3]) : 0.05;
+  std::vector<std::string> instances = {
+    "test/I40j_2m_S1_1.txt", "test/I40j_4m_S1_1.txt",
+    "test/I40j_6m_S1_1.txt", "test/I40j_8m_S1_1.txt"
+  };
+  if (argc > 4) {
+    instances.clear();
+    for (int i = 4; i < argc; i++) {
+      instances.push_back(argv[i]);
+    }
+  }
+  const std::vector<std::string> names = {"GVNSSolver", "GRASPSolver"};
+  std::cout << "instance\tsolver\ttarget\tprobability\ttime\n";
+  for (const std::string& instance : instances) {
+    Problem problem(instance);
+    Algorithm algorithm(&problem);
+    algorithm.setTimeLimit(time_limit);
+    for (int s = 0; s < 2; s++) {
+      // Trace of each run
+      std::vector<std::vector<std::pair<double, int>>> traces = {};
+      int best_cost = INT_MAX;
+      for (int run = 0; run < num_runs; run++) {
+        Solution solution(problem.getNumVehicles());
+        if (s == 0) {
+          algorithm.setSeed(run + 1);
+          solution = algorithm.GVNSSolver();
+        } else {
+          solution = algorithm.GRASPSolver(GRASP_MAX_ITERATIONS, run + 1, 2);
+        }
+        best_cost = std::min(best_cost, solution.getCost());
+        traces.push_back(algorithm.getTrace());
+      }
+      int target = std::floor(best_cost * (1 + gap));
+      std::vector<double> times = {};
+      for (const auto& trace : traces) {
+        for (const std::pair<double, int>& improvement : trace) {
+          if (improvement.second <= target) {
+            times.push_back(improvement.first);
+            break;
+          }
+        }
+      }
+      std::sort(times.begin(), times.end());
+      for (size_t i = 0; i < times.size(); i++) {
+        std::cout << instance << "\t" << names[s] << "\t" << target << "\t"
+                  << (i + 0.5) / num_runs << "\t" << times[i] << " ms\n";
+      }
+      std::cout << instance << "\t" << names[s] << "\t" << target
+                << "\treached " << times.size() << "/" << num_runs << "\n";
+    }
+  }
+  return 0;
+}
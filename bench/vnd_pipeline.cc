@@ -0,0 +1,198 @@
+/**
+ * @file vnd_pipeline.cc
+ * @author Airam Rafael Luque León (alu0101335148@ull.edu.es)
+ * @brief Benchmark of the VND pipelines against the switch dispatch.
+ * @details The switch dispatch is the former GVNSProcedure: an integer
+ * selects the neighborhood of each stage, and every route goes through a
+ * pointer to a public procedure of LocalSearch (that chooses the view of the
+ * distances again). Both descents are applied to the same GRC solutions and
+ * to shakings of their local optima, reporting the time per descent (best of
+ * BENCH_RUNS runs) and the total cost (it must be the same).
+ * Usage: bench_vnd_pipeline.exe [num_vehicles] [descents] [num_clients...]
+ * @version 0.1
+ * @date 2022-05-28
+ */
+
+#include "../src/algorithm.h"
+#include "bench_utils.h"
+
+const int BENCH_RUNS = 5;
+
+/**
+ * @brief Applies a neighborhood of the switch dispatch to the changed routes
+ * @return true if a route was improved
+ */
+static bool improveRoutes(LocalSearch& local_search, int neighborhood,
+                          bool (LocalSearch::*procedure)(Route&),
+                          Solution& solution, DontLookBits& dont_look_bits) {
+  std::vector<Route>& routes = solution.getRoutes();
+  bool improved = false;
+  for (int i = 0; i < routes.size(); i++) {
+    if (!dont_look_bits.isDirty(neighborhood, i)) {continue;}
+    if ((local_search.*procedure)(routes[i])) {
+      dont_look_bits.setModified(i);
+      improved = true;
+    }
+    dont_look_bits.setChecked(neighborhood, i);
+  }
+  return improved;
+}
+
+/**
+ * @brief Applies a neighborhood of the switch dispatch to the changed pairs
+ * @return true if a pair of routes was improved
+ */
+static bool improveRoutePairs(LocalSearch& local_search, int neighborhood,
+                              bool (LocalSearch::*procedure)(Route&, Route&),
+                              Solution& solution,
+                              DontLookBits& dont_look_bits) {
+  std::vector<Route>& routes = solution.getRoutes();
+  bool improved = false;
+  for (int i = 0; i < routes.size(); i++) {
+    for (int j = i + 1; j < routes.size(); j++) {
+      if (!dont_look_bits.isDirty(neighborhood, i, j)) {continue;}
+      if ((local_search.*procedure)(routes[i], routes[j])) {
+        dont_look_bits.setModified(i);
+        dont_look_bits.setModified(j);
+        improved = true;
+      }
+      dont_look_bits.setChecked(neighborhood, i, j);
+    }
+  }
+  return improved;
+}
+
+/**
+ * @brief Descent of the former GVNSProcedure (switch over the stages)
+ * @param local_search
+ * @param solution
+ * @param dont_look_bits
+ * @param num_neighborhoods stages of the pipeline (4: CLASSIC_VND, 7:
+ * SEGMENT_VND)
+ */
+static void switchVND(LocalSearch& local_search, Solution& solution,
+                      DontLookBits& dont_look_bits, int num_neighborhoods) {
+  int local_searchs_finished = 0;
+  int start_cost = 0;
+  do {
+    start_cost = solution.calculateCost();
+    local_searchs_finished = 0;
+    do {
+      bool improved = false;
+      switch (local_searchs_finished) {
+        case 0:
+          improved = improveRoutes(
+              local_search, 0, &LocalSearch::intraRouteReinsertionProcedure,
+              solution, dont_look_bits);
+          break;
+        case 1:
+          improved = improveRoutePairs(
+              local_search, 1, &LocalSearch::interRouteReinsertionProcedure,
+              solution, dont_look_bits);
+          break;
+        case 2:
+          improved = improveRoutes(
+              local_search, 2, &LocalSearch::intraRouteSwapProcedure,
+              solution, dont_look_bits);
+          break;
+        case 3:
+          improved = improveRoutePairs(
+              local_search, 3, &LocalSearch::interRouteSwapProcedure,
+              solution, dont_look_bits);
+          break;
+        case 4:
+          improved = improveRoutes(
+              local_search, 4, &LocalSearch::intraRouteOrOptProcedure,
+              solution, dont_look_bits);
+          break;
+        case 5:
+          improved = improveRoutePairs(
+              local_search, 5, &LocalSearch::interRouteOrOptProcedure,
+              solution, dont_look_bits);
+          break;
+        case 6:
+          improved = improveRoutePairs(
+              local_search, 6, &LocalSearch::crossExchangeProcedure,
+              solution, dont_look_bits);
+          break;
+        default:
+          break;
+      }
+      if (improved) {
+        solution.calculateCost();
+        local_searchs_finished = 0;
+      } else {
+        local_searchs_finished++;
+      }
+    } while (local_searchs_finished < num_neighborhoods);
+  } while (solution.getCost() < start_cost);
+}
+
+int main(int argc, char* argv[]) {
+  int num_vehicles = (argc > 1) ? std::stoi(argv[1]) : 8;
+  int num_descents = (argc > 2) ? std::stoi(argv[2]) : 20;
+  std::vector<int> sizes = {100, 200, 500};
+  if (argc > 3) {
+    sizes.clear();
+    for (int i = 3; i < argc; i++) {
+      sizes.push_back(std::stoi(argv[i]));
+    }
+  }
+  const std::vector<std::string> names = {"CLASSIC_VND", "SEGMENT_VND"};
+  const VNDPipeline pipelines[2] = {CLASSIC_VND, SEGMENT_VND};
+  const int stages[2] = {ClassicVND::SIZE, SegmentVND::SIZE};
+  bool same_costs = true;
+  std::cout << "clients\tpipeline\tstart\tswitch time\tpipeline time"
+            << "\tswitch cost\tpipeline cost\n";
+  for (int num_clients : sizes) {
+    Problem problem = syntheticProblem(num_clients, num_vehicles, 1);
+    Algorithm algorithm(&problem);
+    algorithm.setSeed(1);
+    LocalSearch local_search;
+    local_search.setProblem(&problem);
+    DontLookBits dont_look_bits;
+    for (int p = 0; p < 2; p++) {
+      // GRC solutions and a shaking of their local optima
+      std::vector<Solution> starts[2];
+      for (int d = 0; d < num_descents; d++) {
+        Solution solution = algorithm.GRC(d + 1);
+        starts[0].push_back(solution);
+        dont_look_bits.reset(VND_MAX_NEIGHBORHOODS, solution.getRoutes().size());
+        local_search.runVND(solution, dont_look_bits, pipelines[p]);
+        algorithm.ShakingSolution(solution, 2);
+        solution.calculateCost();
+        starts[1].push_back(solution);
+      }
+      for (int s = 0; s < 2; s++) {
+        double times[2] = {0, 0};
+        long costs[2] = {0, 0};
+        for (int method = 0; method < 2; method++) {
+          for (int run = 0; run < BENCH_RUNS; run++) {
+            std::vector<Solution> solutions = starts[s];
+            long cost = 0;
+            BenchTimer timer;
+            for (Solution& solution : solutions) {
+              dont_look_bits.reset(VND_MAX_NEIGHBORHOODS,
+                                   solution.getRoutes().size());
+              if (method == 0) {
+                switchVND(local_search, solution, dont_look_bits, stages[p]);
+              } else {
+                local_search.runVND(solution, dont_look_bits, pipelines[p]);
+              }
+              cost += solution.getCost();
+            }
+            double time = timer.elapsedMs() / num_descents;
+            times[method] = (run == 0) ? time : std::min(times[method], time);
+            costs[method] = cost;
+          }
+        }
+        same_costs = same_costs && costs[0] == costs[1];
+        std::cout << num_clients << "\t" << names[p] << "\t"
+                  << ((s == 0) ? "GRC" : "shaken") << "\t" << times[0]
+                  << " ms\t" << times[1] << " ms\t" << costs[0] << "\t"
+                  << costs[1] << "\n";
+      }
+    }
+  }
+  return same_costs ? 0 : 1;
+}